@@ -0,0 +1,87 @@
+#!/bin/bash
+#
+# Compare jobs/sec for lab06_batch, read from a file and over a Unix socket,
+# against starting one find_min process per job. Run from the batch
+# directory after building lab06_batch, or use 'make bench'. find_min is
+# rebuilt with the same PROFILE so both sides use the same optimization.
+# The socket case needs python3 and is skipped without it.
+#
+# Usage: ./batch_bench.sh [batch jobs] [process jobs]
+#
+
+BATCH_JOBS=${1:-1000000}
+PROCESS_JOBS=${2:-2000}
+PROFILE=${PROFILE:-release}
+
+make -s -C ../part-1 clean > /dev/null 2>&1
+make -s -C ../part-1 CXX="${CXX:-clang++}" PROFILE="$PROFILE" > /dev/null \
+  || exit 1
+
+SEEDED=$(mktemp)
+UNSEEDED=$(mktemp)
+SOCKET=$(mktemp -u)
+SERVER=
+trap 'rm -f "$SEEDED" "$UNSEEDED" "$SOCKET"; [ -n "$SERVER" ] && kill "$SERVER"' EXIT
+awk -v n="$BATCH_JOBS" 'BEGIN { for (i = 1; i <= n; i++) print 1, 1000, 10, i, "min" }' > "$SEEDED"
+awk -v n="$BATCH_JOBS" 'BEGIN { for (i = 1; i <= n; i++) print 1, 1000, 10, "-", "min" }' > "$UNSEEDED"
+
+# Print the jobs/sec for running BATCH_JOBS jobs with the given command.
+rate() {
+  local start end
+  start=$(date +%s%N)
+  "$@" > /dev/null
+  end=$(date +%s%N)
+  echo $(( BATCH_JOBS * 1000000000 / (end - start) ))
+}
+
+# Send the jobs in the file $1 to the socket, reading results while writing
+# so neither end blocks on a full socket buffer.
+socket_client() {
+  python3 - "$SOCKET" "$1" <<'PYTHON'
+import socket, sys, threading
+client = socket.socket(socket.AF_UNIX)
+client.connect(sys.argv[1])
+with open(sys.argv[2], 'rb') as jobs:
+  data = jobs.read()
+def send():
+  client.sendall(data)
+  client.shutdown(socket.SHUT_WR)
+sender = threading.Thread(target=send)
+sender.start()
+while client.recv(1 << 16):
+  pass
+sender.join()
+PYTHON
+}
+
+SEEDED_RATE=$(rate ./lab06_batch "$SEEDED")
+UNSEEDED_RATE=$(rate ./lab06_batch "$UNSEEDED")
+
+START=$(date +%s%N)
+for (( i = 0; i < PROCESS_JOBS; i++ )); do
+  ../part-1/find_min 1 1000 > /dev/null
+done
+END=$(date +%s%N)
+PROCESS_RATE=$(( PROCESS_JOBS * 1000000000 / (END - START) ))
+
+echo "find_min per job:              $PROCESS_RATE jobs/sec ($PROCESS_JOBS jobs)"
+echo "lab06_batch seeded:            $SEEDED_RATE jobs/sec ($BATCH_JOBS jobs)," \
+     "$(( SEEDED_RATE / PROCESS_RATE ))x"
+echo "lab06_batch unseeded:          $UNSEEDED_RATE jobs/sec ($BATCH_JOBS jobs)," \
+     "$(( UNSEEDED_RATE / PROCESS_RATE ))x"
+
+if ! command -v python3 > /dev/null; then
+  echo "lab06_batch --socket:          skipped, python3 not found"
+  exit 0
+fi
+./lab06_batch --socket "$SOCKET" &
+SERVER=$!
+while [ ! -S "$SOCKET" ]; do
+  sleep 0.1
+done
+SOCKET_SEEDED_RATE=$(rate socket_client "$SEEDED")
+SOCKET_UNSEEDED_RATE=$(rate socket_client "$UNSEEDED")
+echo "lab06_batch --socket seeded:   $SOCKET_SEEDED_RATE jobs/sec" \
+     "($BATCH_JOBS jobs), $(( SOCKET_SEEDED_RATE / PROCESS_RATE ))x"
+echo "lab06_batch --socket unseeded: $SOCKET_UNSEEDED_RATE jobs/sec" \
+     "($BATCH_JOBS jobs), $(( SOCKET_UNSEEDED_RATE / PROCESS_RATE ))x"
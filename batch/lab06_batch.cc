@@ -0,0 +1,415 @@
+// Yamato Eguchi
+// CPSC 120-01
+// 2021-03-20
+// yamatoe1227@csu.fullerton.edu
+// @yamatoeguchi
+//
+// Lab 06-01
+//
+// This is the batch runner for find_min, calc_average and guessing_game
+//
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../common/lab06_core.h"
+
+using namespace std;
+
+/// max_job_elements is the largest size a single job may ask for. It keeps
+/// one bad job from exhausting the memory of the long-lived process.
+const long long max_job_elements = 1 << 24;
+
+/// max_line_length is the longest job spec a socket client may send. Longer
+/// lines are answered with an error instead of being buffered.
+const size_t max_line_length = 4096;
+
+/// flush_threshold is how many bytes of results are collected before they
+/// are written out.
+const size_t flush_threshold = 1 << 16;
+
+/// read_size is how many bytes of job specs are read from a socket client
+/// at a time.
+const size_t read_size = 1 << 16;
+
+/// Job is the result of ParseJob. When \p ok is true the remaining fields
+/// hold a validated job. Otherwise \p error describes what was wrong with
+/// the job spec.
+struct Job {
+  /// True when the job spec was converted and validated
+  bool ok = false;
+  /// The lowest value the random number generator will return
+  int minimum = 0;
+  /// The largest value the random number generator will return
+  int maximum = 0;
+  /// The number of random numbers to generate
+  size_t size = 0;
+  /// True when the job gave a seed; otherwise the running generator is used
+  bool seeded = false;
+  /// The seed for the random number generator
+  unsigned int seed = 0;
+  /// One of min, average or secret
+  string operation;
+  /// The reason the job spec was rejected when \p ok is false
+  string error;
+};
+
+/// ReadNumber converts the next whitespace separated field at \p cursor to
+/// \p value and moves \p cursor past it. It uses strtoll rather than a
+/// stringstream because it runs once per field of every job.
+///
+/// \param cursor The position in the job spec to read from.
+/// \param value Set to the number that was read.
+///
+/// \returns True when a whole number was read
+bool ReadNumber(const char*& cursor, long long& value) {
+  char* end = nullptr;
+  errno = 0;
+  value = strtoll(cursor, &end, 10);
+  if (end == cursor || errno == ERANGE ||
+      (*end != '\0' && *end != ' ' && *end != '\t' && *end != '\r')) {
+    return false;
+  }
+  cursor = end;
+  return true;
+}
+
+/// ParseJob converts and validates one job spec of the form
+/// \code
+/// minimum maximum size seed operation
+/// \endcode
+/// where operation is min (what find_min prints), average (what
+/// calc_average prints) or secret (the secret number guessing_game picks).
+/// A seed of - continues the running generator instead of reseeding it,
+/// which is how the programs behave and is much faster than reseeding.
+///
+/// \param line The job spec, without the trailing newline.
+///
+/// \returns A Job with \p ok set when \p line is a valid job spec
+Job ParseJob(const string& line) {
+  Job job;
+  const char* cursor = line.c_str();
+  long long minimum = 0;
+  long long maximum = 0;
+  long long size = 0;
+  long long seed = 0;
+  if (!ReadNumber(cursor, minimum) || !ReadNumber(cursor, maximum) ||
+      !ReadNumber(cursor, size)) {
+    job.error = "Expected: minimum maximum size seed operation.";
+    return job;
+  }
+  const char* whitespace = " \t\r";
+  cursor += strspn(cursor, whitespace);
+  if (cursor[0] == '-' && strchr(whitespace, cursor[1]) != nullptr &&
+      cursor[1] != '\0') {
+    cursor++;
+  } else if (ReadNumber(cursor, seed)) {
+    job.seeded = true;
+  } else {
+    job.error = "Expected: minimum maximum size seed operation.";
+    return job;
+  }
+  cursor += strspn(cursor, whitespace);
+  size_t operation_length = strcspn(cursor, whitespace);
+  job.operation.assign(cursor, operation_length);
+  cursor += operation_length;
+  if (job.operation.empty() || cursor[strspn(cursor, whitespace)] != '\0') {
+    job.error = "Expected: minimum maximum size seed operation.";
+    return job;
+  }
+  if (minimum < INT32_MIN || minimum > INT32_MAX || maximum < INT32_MIN ||
+      maximum > INT32_MAX) {
+    job.error = "Minimum and maximum numbers must fit in an int.";
+    return job;
+  }
+  Bounds bounds = MakeBounds(static_cast<int>(minimum),
+                             static_cast<int>(maximum));
+  if (!bounds.ok) {
+    job.error = bounds.error;
+    return job;
+  }
+  if (size < 1 || size > max_job_elements) {
+    job.error = "Size must be between 1 and " +
+                to_string(max_job_elements) + ".";
+    return job;
+  }
+  if (seed < 0 || seed > UINT32_MAX) {
+    job.error = "Seed must be between 0 and " + to_string(UINT32_MAX) + ".";
+    return job;
+  }
+  if (job.operation != "min" && job.operation != "average" &&
+      job.operation != "secret") {
+    job.error = "Operation must be min, average or secret.";
+    return job;
+  }
+  job.minimum = bounds.minimum;
+  job.maximum = bounds.maximum;
+  job.size = static_cast<size_t>(size);
+  job.seed = static_cast<unsigned int>(seed);
+  job.ok = true;
+  return job;
+}
+
+/// The BatchRunner class runs job specs one after another while keeping the
+/// random number generator and the array buffer alive between jobs, so
+/// each job costs only a reseed and the kernel itself.
+class BatchRunner {
+ private:
+  /// The generator shared by every job; seeded once from the hardware
+  /// entropy source and reseeded only by jobs that give a seed
+  RandomNumberGenerator rng{1, 2};
+  /// The buffer shared by every job; it only grows
+  vector<int> buffer;
+
+ public:
+  /// Run the job spec in \p line and append exactly one result line to
+  /// \p results. A job that fails to parse produces a line starting with
+  /// "error: " and does not stop the batch.
+  ///
+  /// \param line The job spec, without the trailing newline.
+  /// \param results The string the result line is appended to.
+  void run(const string& line, string& results) {
+    Job job = ParseJob(line);
+    if (!job.ok) {
+      results += "error: " + job.error + "\n";
+      return;
+    }
+    if (job.seeded) {
+      rng.reseed(job.minimum, job.maximum, job.seed);
+    } else {
+      rng.set_range(job.minimum, job.maximum);
+    }
+    if (job.operation == "secret") {
+      results += to_string(rng.next()) + "\n";
+      return;
+    }
+    if (buffer.size() < job.size) {
+      buffer.resize(job.size);
+    }
+    auto first = buffer.begin();
+    auto last = first + static_cast<ptrdiff_t>(job.size);
+    FillArray(first, last, rng);
+    if (job.operation == "min") {
+      results += to_string(FindMinimum(first, last)) + "\n";
+    } else {
+      // Match the formatting of cout << float in calc_average.
+      char average[32];
+      snprintf(average, sizeof(average), "%g", CalculateAverage(first, last));
+      results += string(average) + "\n";
+    }
+  }
+};
+
+/// IsBlank returns true when \p line holds nothing but whitespace. Blank
+/// lines are skipped rather than reported as errors.
+///
+/// \param line The line to check.
+///
+/// \returns True when \p line is empty or only whitespace
+bool IsBlank(const string& line) {
+  return line.find_first_not_of(" \t\r") == string::npos;
+}
+
+/// RunJobs reads one job spec per line from \p jobs and writes one result
+/// line per job to \p results.
+///
+/// \param jobs The stream of job specs.
+/// \param results The stream the result lines are written to.
+/// \param runner The runner shared by every job.
+void RunJobs(istream& jobs, ostream& results, BatchRunner& runner) {
+  string line;
+  string pending;
+  while (getline(jobs, line)) {
+    if (IsBlank(line)) {
+      continue;
+    }
+    runner.run(line, pending);
+    if (pending.size() >= flush_threshold) {
+      results << pending;
+      pending.clear();
+    }
+  }
+  results << pending << flush;
+}
+
+/// WriteAll writes all of \p data to \p descriptor, retrying short writes.
+///
+/// \param descriptor The socket to write to.
+/// \param data The bytes to write.
+///
+/// \returns True when every byte was written
+bool WriteAll(int descriptor, const string& data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t count =
+        write(descriptor, data.data() + written, data.size() - written);
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count <= 0) {
+      return false;
+    }
+    written += static_cast<size_t>(count);
+  }
+  return true;
+}
+
+/// ServeClient runs the job specs sent by one client on \p descriptor and
+/// sends back one result line per job until the client closes its end.
+///
+/// Results are sent after every read, so a client must read results while
+/// it is still writing job specs; otherwise both ends can block on full
+/// socket buffers. A job spec longer than max_line_length is answered with
+/// an error line and the rest of it is thrown away.
+///
+/// \param descriptor The connected client socket.
+/// \param runner The runner shared by every job.
+void ServeClient(int descriptor, BatchRunner& runner) {
+  const string too_long = "error: Job spec is longer than " +
+                          to_string(max_line_length) + " bytes.\n";
+  char chunk[read_size];
+  string received;
+  string results;
+  // True while the rest of an overlong job spec is being thrown away.
+  bool discarding = false;
+  while (true) {
+    ssize_t count = read(descriptor, chunk, sizeof(chunk));
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count <= 0) {
+      break;
+    }
+    received.append(chunk, static_cast<size_t>(count));
+    size_t start = 0;
+    size_t end = 0;
+    while ((end = received.find('\n', start)) != string::npos) {
+      if (discarding) {
+        discarding = false;
+      } else if (end - start > max_line_length) {
+        results += too_long;
+      } else {
+        string line = received.substr(start, end - start);
+        if (!IsBlank(line)) {
+          runner.run(line, results);
+        }
+      }
+      start = end + 1;
+    }
+    received.erase(0, start);
+    if (received.size() > max_line_length) {
+      if (!discarding) {
+        results += too_long;
+        discarding = true;
+      }
+      received.clear();
+    }
+    if (!WriteAll(descriptor, results)) {
+      return;
+    }
+    results.clear();
+  }
+  // A last job spec without a trailing newline.
+  if (!discarding && !IsBlank(received)) {
+    runner.run(received, results);
+    WriteAll(descriptor, results);
+  }
+}
+
+/// ServeSocket listens on the Unix socket at \p path and serves clients one
+/// at a time, forever.
+///
+/// \param path The file system path of the socket; a stale socket there is
+/// replaced, but any other kind of file is left alone and is an error.
+/// \param runner The runner shared by every client.
+///
+/// \returns The reason the socket could not be served
+string ServeSocket(const string& path, BatchRunner& runner) {
+  sockaddr_un address{};
+  if (path.size() >= sizeof(address.sun_path)) {
+    return "Socket path is too long.";
+  }
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+  struct stat existing {};
+  if (lstat(path.c_str(), &existing) == 0) {
+    if (!S_ISSOCK(existing.st_mode)) {
+      return path + " exists and is not a socket.";
+    }
+    unlink(path.c_str());
+  }
+
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener < 0) {
+    return string("Could not create socket: ") + strerror(errno);
+  }
+  if (bind(listener, reinterpret_cast<sockaddr*>(&address),
+           sizeof(address)) < 0 ||
+      listen(listener, SOMAXCONN) < 0) {
+    string error = string("Could not listen on ") + path + ": " +
+                   strerror(errno);
+    close(listener);
+    return error;
+  }
+  // A client that disconnects early must not kill the server.
+  signal(SIGPIPE, SIG_IGN);
+  while (true) {
+    int client = accept(listener, nullptr, nullptr);
+    if (client < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      string error = string("Could not accept a client: ") + strerror(errno);
+      close(listener);
+      return error;
+    }
+    ServeClient(client, runner);
+    close(client);
+  }
+}
+
+/// Entry point to the lab06_batch program
+/// \remark Must have at least 1 argument. Either the path of a file of job
+/// specs, - to read job specs from standard input, or --socket followed by
+/// the path of a Unix socket to serve job specs on.
+int main(int argc, char* argv[]) {
+  ios::sync_with_stdio(false);
+  if (argc < 2 || (string(argv[1]) == "--socket" && argc < 3)) {
+    ErrorMessage(
+        "Please provide a file of job specs, - for standard input, or "
+        "--socket and a socket path.");
+    return 1;
+  }
+  BatchRunner runner;
+  string source = string(argv[1]);
+  if (source == "--socket") {
+    ErrorMessage(ServeSocket(string(argv[2]), runner));
+    return 1;
+  }
+  if (source == "-") {
+    RunJobs(cin, cout, runner);
+    return 0;
+  }
+  ifstream jobs(source);
+  if (!jobs) {
+    ErrorMessage("Could not open " + source + ".");
+    return 1;
+  }
+  RunJobs(jobs, cout, runner);
+  return 0;
+}
@@ -0,0 +1,163 @@
+// Yamato Eguchi
+// CPSC 120-01
+// 2021-03-20
+// yamatoe1227@csu.fullerton.edu
+// @yamatoeguchi
+//
+// Lab 06-01
+//
+// This is the benchmark for the find_min and calc_average kernels
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "../common/lab06_core.h"
+
+using namespace std;
+
+/// bench_elements defines how large the benchmark array is. It is much larger
+/// than the ten elements used by the programs so that the loop body, and not
+/// the call overhead, dominates the measurement.
+const int bench_elements = 1 << 16;
+
+/// bench_repetitions defines how many times each kernel is run per timing.
+const int bench_repetitions = 2000;
+
+/// FillArrayChecked is the original find_min kernel for filling the array:
+/// every store goes through at() inside a try/catch. It is the baseline for
+/// the unchecked FillArray in lab06_core.h.
+///
+/// \param the_array The array of integers to fill.
+/// \param random_number_generator The generator the values come from.
+void FillArrayChecked(array<int, bench_elements>& the_array,
+                      RandomNumberGenerator& random_number_generator) {
+  for (size_t index = 0; index < the_array.size(); index++) {
+    try {
+      the_array.at(index) = random_number_generator.next();
+    } catch (const exception& e) {
+      exit(1);
+    }
+  }
+}
+
+/// FindMinimumChecked is the original find_min kernel: the zeroth element is
+/// read through at() inside a try/catch and the loop compares with a branch.
+/// It is kept here only as the baseline for the unchecked FindMinimum in
+/// lab06_core.h.
+///
+/// \param the_array The array of integers to search.
+///
+/// \returns The minimum/smallest value in the array
+int FindMinimumChecked(const array<int, bench_elements>& the_array) {
+  int the_minimum = 0;
+  try {
+    the_minimum = the_array.at(0);
+  } catch (const exception& e) {
+    exit(1);
+  }
+  for (const auto& element : the_array) {
+    if (element < the_minimum) {
+      the_minimum = element;
+    }
+  }
+  return the_minimum;
+}
+
+/// CalculateAverageChecked is the original calc_average kernel: a float
+/// accumulator with a division and a try/catch on every iteration. It is the
+/// baseline for the unchecked CalculateAverage in lab06_core.h.
+///
+/// \param the_array The array of integers to average.
+///
+/// \returns The average (arithmetic mean) value in the array as a float
+float CalculateAverageChecked(const array<int, bench_elements>& the_array) {
+  float sum = 0.0;
+  float average = 0.0;
+  for (const auto& element : the_array) {
+    try {
+      sum = sum + element;
+      average = sum / the_array.size();
+    } catch (const exception& e) {
+      exit(1);
+    }
+  }
+  return average;
+}
+
+/// TimeKernel runs \p kernel over \p the_array bench_repetitions times and
+/// prints the average number of nanoseconds spent per element.
+///
+/// \param name The label printed in front of the measurement.
+/// \param the_array The array handed to \p kernel.
+/// \param kernel The function being measured.
+///
+/// \returns The nanoseconds spent per element
+template <typename Kernel>
+double TimeKernel(const string& name,
+                  const array<int, bench_elements>& the_array, Kernel kernel) {
+  // The volatile sink keeps the compiler from discarding the results.
+  volatile double sink = 0;
+  auto start = chrono::steady_clock::now();
+  for (int repetition = 0; repetition < bench_repetitions; repetition++) {
+    sink = sink + kernel(the_array);
+  }
+  auto stop = chrono::steady_clock::now();
+  double nanoseconds =
+      chrono::duration<double, nano>(stop - start).count() /
+      (static_cast<double>(bench_repetitions) * bench_elements);
+  cout << name << ": " << nanoseconds << " ns/element\n";
+  return nanoseconds;
+}
+
+/// Entry point to the kernel_bench program
+/// \remark Takes no arguments. The array is filled from a fixed seed so runs
+/// are comparable.
+int main() {
+  // Static storage; the array is too large for the stack.
+  static array<int, bench_elements> random_numbers{};
+  mt19937 mt_engine{120};
+  uniform_int_distribution<> uniform_dist{1, 1000000};
+  for (auto& element : random_numbers) {
+    element = uniform_dist(mt_engine);
+  }
+
+  // The fill kernels write to their own array and ignore the one they are
+  // handed; the first element is returned so the fill cannot be discarded.
+  static array<int, bench_elements> fill_target{};
+  RandomNumberGenerator rng{1, 1000000};
+  double fill_checked = TimeKernel(
+      "FillArrayChecked         ", random_numbers,
+      [&](const array<int, bench_elements>& /*unused*/) {
+        FillArrayChecked(fill_target, rng);
+        return fill_target[0];
+      });
+  double fill_unchecked = TimeKernel(
+      "FillArray                ", random_numbers,
+      [&](const array<int, bench_elements>& /*unused*/) {
+        FillArray(fill_target, rng);
+        return fill_target[0];
+      });
+  double min_checked =
+      TimeKernel("FindMinimumChecked       ", random_numbers,
+                 FindMinimumChecked);
+  double min_unchecked =
+      TimeKernel("FindMinimum              ", random_numbers,
+                 FindMinimum<int, bench_elements>);
+  double average_checked =
+      TimeKernel("CalculateAverageChecked  ", random_numbers,
+                 CalculateAverageChecked);
+  double average_unchecked =
+      TimeKernel("CalculateAverage         ", random_numbers,
+                 CalculateAverage<bench_elements>);
+  cout << "FillArray speedup: " << fill_checked / fill_unchecked << "x\n";
+  cout << "FindMinimum speedup: " << min_checked / min_unchecked << "x\n";
+  cout << "CalculateAverage speedup: " << average_checked / average_unchecked
+       << "x\n";
+  return 0;
+}
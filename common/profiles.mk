@@ -0,0 +1,73 @@
+#
+# Build profiles shared by the part-1, part-2, part-3, bench and batch
+# Makefiles.
+# Include this file after CFLAGS and LDFLAGS are set and after the default
+# rule; it defines the pgo rule, which would otherwise become the default
+# goal.
+#
+# Select a profile with PROFILE=<name>, e.g. make PROFILE=release.
+#
+#   debug    -g and no optimization (the default)
+#   release  -O3
+#   march    -O3 -march=$(MARCH); MARCH defaults to native, so the binary
+#            may not run on other machines. Use MARCH=x86-64-v3 or similar
+#            for a portable build.
+#   lto      march plus link time optimization
+#
+# For profile guided optimization run 'make pgo' rather than setting
+# PROFILE. It builds an instrumented lto binary, runs $(PGO_WORKLOAD), and
+# then rebuilds using the collected profile.
+#
+# Profiles do not share object files, so run 'make clean' when switching.
+#
+
+PROFILE ?= debug
+MARCH ?= native
+PGODIR = pgo-data
+
+# clang writes raw profiles that must be merged with llvm-profdata before
+# they can be used; gcc reads its .gcda files directly.
+PROFDATA = llvm-profdata
+IS_CLANG := $(shell $(CXX) --version 2>/dev/null | grep -c clang)
+ifeq ($(IS_CLANG),0)
+PGO_USE_FLAGS = -fprofile-use=$(CURDIR)/$(PGODIR) -fprofile-correction \
+                -Wno-missing-profile
+else
+PGO_USE_FLAGS = -fprofile-use=$(CURDIR)/$(PGODIR)/default.profdata
+endif
+
+ifeq ($(PROFILE),debug)
+OPTFLAGS =
+else ifeq ($(PROFILE),release)
+OPTFLAGS = -O3 -DNDEBUG
+else ifeq ($(PROFILE),march)
+OPTFLAGS = -O3 -DNDEBUG -march=$(MARCH)
+else ifeq ($(PROFILE),lto)
+OPTFLAGS = -O3 -DNDEBUG -march=$(MARCH) -flto
+else ifeq ($(PROFILE),pgo-generate)
+OPTFLAGS = -O3 -DNDEBUG -march=$(MARCH) -flto \
+           -fprofile-generate=$(CURDIR)/$(PGODIR)
+else ifeq ($(PROFILE),pgo-use)
+OPTFLAGS = -O3 -DNDEBUG -march=$(MARCH) -flto $(PGO_USE_FLAGS)
+else ifeq ($(PROFILE),pgo)
+$(error PGO needs a training run; use 'make pgo' instead of PROFILE=pgo)
+else
+$(error Unknown PROFILE '$(PROFILE)'; use debug, release, march or lto, \
+        or run 'make pgo')
+endif
+
+CFLAGS += $(OPTFLAGS)
+LDFLAGS += $(OPTFLAGS)
+
+pgo:
+	-rm -rf $(PGODIR)
+	$(MAKE) clean
+	$(MAKE) PROFILE=pgo-generate $(TARGET)
+	$(PGO_WORKLOAD)
+ifneq ($(IS_CLANG),0)
+	$(PROFDATA) merge -output=$(PGODIR)/default.profdata $(PGODIR)/*.profraw
+endif
+	$(MAKE) clean
+	$(MAKE) PROFILE=pgo-use $(TARGET)
+
+.PHONY: pgo
@@ -9,71 +9,17 @@
 // This is my guessing_game assignment
 //
 
-// Add the following header files algorithm, array, cstdlib,
-// iostream, random
-#include<algorithm>
-#include<array>
-#include<cstdlib>
-#include<iostream>
-#include<random>
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <string>
 
-using namespace std;
+#include "../common/lab06_core.h"
 
-/// The RandomNumberGenerator class is a wrapper around the Standard C++
-/// Library's Mersenne Twister pseudo random number generator.
-/// This class is complete and correct; please do not make any changes to it.
-///
-/// In lieu of directly working with the [Mersenne Twister
-/// class]
-/// (https://en.cppreference.com/w/cpp/numeric/random/mersenne_twister_engine),
-/// this class serves as a lightweight wrapper around the necessary elements of
-/// the library. The usage of this class is very simple and requires a
-/// minimum and maximum value for initialization.
-/// \code
-/// int minimum_random_number = 1;
-/// int maximum_random_number = 10;
-/// RandomNumberGenerator my_random_number_generator{minimum_random_number,
-/// maximum_random_number}; int random_number =
-/// my_random_number_generator.next();
-/// \endcode
-class RandomNumberGenerator {
- private:
-  /// A hardware entropy source (a device on your computer to give random bits)
-  std::random_device rd;
-  /// A sequence of random bits to seed the Mersenne Twister engine
-  std::seed_seq seed;
-  /// A Mersenne Twister engine
-  std::mt19937 mt_engine;
-  /// A uniform distribution; select numbers randomly in a uniform manner
-  std::uniform_int_distribution<> uniform_dist;
+using namespace std;
 
- public:
-  /// Constructor to the RandomNumberGenerator class
-  ///
-  /// The RandomNumberGenerator generates random integer numbers between
-  /// \p minimum and \p maximum. The constructor initializes and prepares
-  /// the engine. To generate a number use the <RandomNumberGenerator::next>()
-  /// method.
-  ///
-  /// \param minimum The lowest value the random number generator will return
-  /// \param maximum The largest value the random number generator will return
-  RandomNumberGenerator(int minimum, int maximum)
-      : seed{rd()}, mt_engine{rd()}, uniform_dist{minimum, maximum} {}
-
-  /// Return a random number
-  ///
-  /// Returns a random integer number between the minimum and maximum set
-  /// when the constructor was called.
-  /// \sa{RandomNumberGenerator::RandomNumberGenerator}
-  ///
-  /// \returns An integer between the minimum and maximum set when
-  /// the constructor was called
-  auto next() -> int {
-    int random_number = uniform_dist(mt_engine);
-    // std::cout << "Debugging: The random number is " << random_number << "\n";
-    return random_number;
-  }
-};
+/// exiting_the_game ends the standard error message printed by ErrorMessage.
+const char* const exiting_the_game = "Exiting the guessing game.";
 
 /// NewGameMessage prints a short message at the start of every game summarizing
 /// the \p minimum_number and \p maximum_number used in the guessing game.
@@ -95,20 +41,6 @@ void NewGameMessage(int minimum_number, int maximum_number) {
   cout << "Let's play a guessing game...\n";
 }
 
-/// ErrorMessage prints out \p message first and then prints the standard
-/// message
-/// \code
-/// "There was an error. Exiting the guessing game.\n".
-/// \endcode
-///
-/// \param message The programmer defined string that specifies the current
-/// error.
-void ErrorMessage(const string& message) {
-  // implement ErrorMessage
-  cout << message << "\n";
-  cout << "There was an error. Exiting the guessing game.\n";
-}
-
 /// GatherGuess prompts the user for a guess, gathers the guess as a string,
 /// converts that string to an integer, and finally returns the integer.
 ///
@@ -127,7 +59,7 @@ int GatherGuess() {
   try {
     PlayerGuess = std::stoi(PlayerInput);
   } catch (const exception& e) {
-    ErrorMessage("Error converting Player Input into Int.");
+    ErrorMessage("Error converting Player Input into Int.", exiting_the_game);
     exit(1);
   }
   return PlayerGuess;
@@ -191,7 +123,7 @@ void WarmerOrColder(int guess, int last_guess, int secret_number) {
       cout << "\tYou're getting colder!\n";
     }
   } catch (const exception& e) {
-    ErrorMessage("Error calculating if warmer or colder.");
+    ErrorMessage("Error calculating if warmer or colder.", exiting_the_game);
     exit(1);
   }
 }
@@ -200,34 +132,13 @@ void WarmerOrColder(int guess, int last_guess, int secret_number) {
 /// \remark Must have at least 2 arguments. The first argument is the minimum
 /// to be guessed and the second argument is the maximum to be guessed.
 int main(int argc, char* argv[]) {
-  if (argc < 3) {
-    ErrorMessage(
-        "Please provide two positive integers as the maximum and "
-        "minimum for this guessing game.");
-    exit(1);
-  }
-  string argv_one_minimum = string(argv[1]);
-  string argv_two_maximum = string(argv[2]);
-  int minimum_number = 0;
-  int maximum_number = 0;
-
-  // convert argv_one_minimum and argv_two_maximum to integers and
-  // assign to minimum_number and maximum_number.
-  try {
-    minimum_number = stoi(argv_one_minimum);
-    maximum_number = stoi(argv_two_maximum);
-  } catch (const exception& e) {
-    ErrorMessage("Error converting string to integer.");
-    exit(1);
-  }
-
-  // Check to make sure minimum_number is less than maximum_number,
-  // and that both of them are greater than zero. Otherwise, print an 
-  // error message an exit.
-  if (minimum_number >= maximum_number || minimum_number <= 0 || maximum_number <= 0) {
-    ErrorMessage("Minimum number must be less than the maximum number and both minimum and maximum numbers must be greater than 0.");
-    exit(1);
+  Bounds bounds = ParseBounds(argc, argv, "guessing game");
+  if (!bounds.ok) {
+    ErrorMessage(bounds.error, exiting_the_game);
+    return 1;
   }
+  int minimum_number = bounds.minimum;
+  int maximum_number = bounds.maximum;
 
   RandomNumberGenerator rng(minimum_number, maximum_number);
   int secret_number = rng.next();